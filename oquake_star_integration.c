@@ -25,6 +25,7 @@
 #else
 #include <sys/stat.h>
 #include <dlfcn.h>
+#include <pthread.h>
 #include <unistd.h>
 #endif
 
@@ -519,7 +520,9 @@ static const oquake_monster_entry_t OQUAKE_MONSTERS[] = {
     { "monster_spawn",     "oquake_spawn",     "Spawn",        100, 0 },
     { "monster_knight",    "oquake_knight",    "Knight",        80, 0 },
     { "monster_wizard",    "oquake_scrag",     "Scrag",         60, 0 },  /* flying creature; classname wizard */
+    { "monster_boss",      "oquake_chthon",    "Chthon",       300, 1 },  /* Chthon; reported through OQ_EVENT_BOSS_KILLED */
     { "monster_shub",      "oquake_shub",      "Shub-Niggurath", 500, 1 },
+    { "monster_oldone",    "oquake_shub",      "Shub-Niggurath", 500, 1 },  /* progs classname for Shub */
     { "shub_niggurath",    "oquake_shub",      "Shub-Niggurath", 500, 1 },
     { NULL, NULL, NULL, 0, 0 }
 };
@@ -708,7 +711,388 @@ static int OQ_DoMintForItemType(const char* item_type)
     return 0;
 }
 
-/* Minimal hooks: C# client does all heavy lifting. Queue pickup-with-mint (mint then add) or queue add_item only. */
+/* ---------------------------------------------------------------------------
+ * NFT mint queue: pickups that mint go here instead of star_api_queue_pickup_with_mint, so a burst
+ * of pickups no longer fights over the single star_api_consume_last_mint_result slot.
+ * One worker thread takes up to OQ_MINT_BATCH_MAX queued jobs for the provider with the oldest
+ * pending job and mints them back to back. Each minted item is added with star_api_add_item rather
+ * than the batched add_item queue, whose flush would also send (and report) jobs queued by the
+ * star_sync inventory and single-item workers. Every result goes into a bounded completion ring
+ * (the oldest is dropped when it is full), which OQuake_STAR_DrainMintResults empties in one call;
+ * that per-frame drain also restarts the worker if it could not be started. Per-provider counters
+ * feed "star mint stats".
+ * --------------------------------------------------------------------------- */
+#define OQ_MINT_JOB_MAX       128  /* queued + in-flight jobs */
+#define OQ_MINT_BATCH_MAX     16   /* jobs per provider submission */
+#define OQ_MINT_DONE_MAX      64   /* completion ring */
+#define OQ_MINT_PROVIDER_MAX  8
+#define OQ_MINT_SHUTDOWN_WAIT_SEC 5.0  /* how long cleanup waits for an in-flight batch */
+
+enum {
+    OQ_MINT_FREE = 0,
+    OQ_MINT_QUEUED,
+    OQ_MINT_RUNNING
+};
+
+typedef struct oq_mint_job_s {
+    int state;
+    char item_name[256];
+    char description[256];
+    char item_type[64];
+    char provider[64];
+    char send_to[128];
+    int quantity;
+    unsigned int seq;     /* FIFO order across providers */
+    double queued_at;     /* OQ_MintClock seconds */
+} oq_mint_job_t;
+
+typedef struct oq_mint_provider_stats_s {
+    char provider[64];
+    int minted;
+    int failed;
+    int batches;
+    double latency_sum;   /* seconds, queue to result */
+    double latency_max;
+    double busy;          /* seconds spent inside batches */
+} oq_mint_provider_stats_t;
+
+static oq_mint_job_t g_oq_mint_jobs[OQ_MINT_JOB_MAX];
+static unsigned int g_oq_mint_seq = 0;
+static oquake_star_mint_result_t g_oq_mint_done[OQ_MINT_DONE_MAX];
+static int g_oq_mint_done_head = 0;  /* oldest undrained result */
+static int g_oq_mint_done_count = 0;
+static int g_oq_mint_done_dropped = 0;
+static oq_mint_provider_stats_t g_oq_mint_stats[OQ_MINT_PROVIDER_MAX];
+static int g_oq_mint_stats_count = 0;
+static int g_oq_mint_worker_running = 0;
+static int g_oq_mint_start_failed = 0;  /* jobs are queued but the worker thread could not be started */
+static volatile int g_oq_mint_stop = 0;
+#ifdef _WIN32
+static CRITICAL_SECTION g_oq_mint_lock;
+static CONDITION_VARIABLE g_oq_mint_idle;  /* signalled when the worker exits */
+static int g_oq_mint_lock_ready = 0;
+#else
+static pthread_mutex_t g_oq_mint_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_oq_mint_idle = PTHREAD_COND_INITIALIZER;
+#endif
+
+static void OQ_MintLock(void) {
+#ifdef _WIN32
+    EnterCriticalSection(&g_oq_mint_lock);
+#else
+    pthread_mutex_lock(&g_oq_mint_lock);
+#endif
+}
+
+static void OQ_MintUnlock(void) {
+#ifdef _WIN32
+    LeaveCriticalSection(&g_oq_mint_lock);
+#else
+    pthread_mutex_unlock(&g_oq_mint_lock);
+#endif
+}
+
+/** Monotonic seconds; safe off the main thread (realtime is not). */
+static double OQ_MintClock(void) {
+#ifdef _WIN32
+    return (double)GetTickCount64() / 1000.0;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+/** Stats slot for provider; the last slot collects any providers past OQ_MINT_PROVIDER_MAX. Call with the lock held. */
+static oq_mint_provider_stats_t* OQ_MintStatsFor(const char* provider) {
+    int i;
+    for (i = 0; i < g_oq_mint_stats_count; i++)
+        if (!strcmp(g_oq_mint_stats[i].provider, provider))
+            return &g_oq_mint_stats[i];
+    if (g_oq_mint_stats_count < OQ_MINT_PROVIDER_MAX) {
+        oq_mint_provider_stats_t* s = &g_oq_mint_stats[g_oq_mint_stats_count++];
+        memset(s, 0, sizeof(*s));
+        q_strlcpy(s->provider, provider, sizeof(s->provider));
+        return s;
+    }
+    return &g_oq_mint_stats[OQ_MINT_PROVIDER_MAX - 1];
+}
+
+/** Claims the next batch: queued jobs sharing the oldest job's provider, in FIFO order. Call with the lock held. */
+static int OQ_MintClaimBatch(oq_mint_job_t* batch) {
+    char provider[64];
+    int i, n = 0, oldest = -1;
+    for (i = 0; i < OQ_MINT_JOB_MAX; i++) {
+        if (g_oq_mint_jobs[i].state != OQ_MINT_QUEUED) continue;
+        if (oldest < 0 || (int)(g_oq_mint_jobs[i].seq - g_oq_mint_jobs[oldest].seq) < 0)
+            oldest = i;
+    }
+    if (oldest < 0) return 0;
+    q_strlcpy(provider, g_oq_mint_jobs[oldest].provider, sizeof(provider));
+    while (n < OQ_MINT_BATCH_MAX) {
+        int next = -1;
+        for (i = 0; i < OQ_MINT_JOB_MAX; i++) {
+            if (g_oq_mint_jobs[i].state != OQ_MINT_QUEUED) continue;
+            if (strcmp(g_oq_mint_jobs[i].provider, provider)) continue;
+            if (next < 0 || (int)(g_oq_mint_jobs[i].seq - g_oq_mint_jobs[next].seq) < 0)
+                next = i;
+        }
+        if (next < 0) break;
+        g_oq_mint_jobs[next].state = OQ_MINT_RUNNING;
+        batch[n++] = g_oq_mint_jobs[next];
+    }
+    return n;
+}
+
+/** Frees the RUNNING slots of a finished batch. Call with the lock held. */
+static void OQ_MintReleaseBatch(const oq_mint_job_t* batch, int n) {
+    int i, j;
+    for (j = 0; j < n; j++)
+        for (i = 0; i < OQ_MINT_JOB_MAX; i++)
+            if (g_oq_mint_jobs[i].state == OQ_MINT_RUNNING && g_oq_mint_jobs[i].seq == batch[j].seq) {
+                g_oq_mint_jobs[i].state = OQ_MINT_FREE;
+                break;
+            }
+}
+
+static void OQ_MintPushDone(const oquake_star_mint_result_t* r) {
+    int slot;
+    if (g_oq_mint_done_count == OQ_MINT_DONE_MAX) {
+        g_oq_mint_done_head = (g_oq_mint_done_head + 1) % OQ_MINT_DONE_MAX;
+        g_oq_mint_done_count--;
+        g_oq_mint_done_dropped++;
+    }
+    slot = (g_oq_mint_done_head + g_oq_mint_done_count) % OQ_MINT_DONE_MAX;
+    g_oq_mint_done[slot] = *r;
+    g_oq_mint_done_count++;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI OQ_MintWorker(LPVOID param) {
+#else
+static void* OQ_MintWorker(void* param) {
+#endif
+    static oq_mint_job_t batch[OQ_MINT_BATCH_MAX];  /* only one worker runs at a time */
+    static oquake_star_mint_result_t results[OQ_MINT_BATCH_MAX];
+    (void)param;
+    for (;;) {
+        double batch_start;
+        int n, i;
+
+        OQ_MintLock();
+        n = g_oq_mint_stop ? 0 : OQ_MintClaimBatch(batch);
+        if (n == 0) {
+            g_oq_mint_worker_running = 0;
+#ifdef _WIN32
+            WakeAllConditionVariable(&g_oq_mint_idle);
+#else
+            pthread_cond_broadcast(&g_oq_mint_idle);
+#endif
+            OQ_MintUnlock();
+            break;
+        }
+        OQ_MintUnlock();
+
+        batch_start = OQ_MintClock();
+        for (i = 0; i < n; i++) {
+            oq_mint_job_t* job = &batch[i];
+            oquake_star_mint_result_t* r = &results[i];
+            memset(r, 0, sizeof(*r));
+            q_strlcpy(r->item_name, job->item_name, sizeof(r->item_name));
+            q_strlcpy(r->provider, job->provider, sizeof(r->provider));
+            r->result = star_api_mint_inventory_nft(job->item_name, job->description, "Quake", job->item_type, job->provider,
+                r->nft_id, r->hash, job->send_to[0] ? job->send_to : NULL);
+            if (r->result == STAR_API_SUCCESS && r->nft_id[0]) {
+                star_api_add_item(job->item_name, job->description, "Quake", job->item_type, r->nft_id, job->quantity, 1);
+            } else {
+                const char* err = star_api_get_last_error();
+                if (r->result == STAR_API_SUCCESS)
+                    r->result = STAR_API_ERROR_API_ERROR;
+                q_strlcpy(r->error, (err && err[0]) ? err : "mint returned no NFT ID", sizeof(r->error));
+                /* Still record the pickup, without an NFT ID, so the item is not lost. */
+                star_api_add_item(job->item_name, job->description, "Quake", job->item_type, NULL, job->quantity, 1);
+            }
+            r->latency = OQ_MintClock() - job->queued_at;
+        }
+
+        OQ_MintLock();
+        {
+            oq_mint_provider_stats_t* s = OQ_MintStatsFor(batch[0].provider);
+            s->batches++;
+            s->busy += OQ_MintClock() - batch_start;
+            for (i = 0; i < n; i++) {
+                if (results[i].result == STAR_API_SUCCESS) s->minted++;
+                else s->failed++;
+                s->latency_sum += results[i].latency;
+                if (results[i].latency > s->latency_max) s->latency_max = results[i].latency;
+                OQ_MintPushDone(&results[i]);
+            }
+        }
+        OQ_MintReleaseBatch(batch, n);
+        OQ_MintUnlock();
+    }
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/** Starts the worker thread; the caller has set g_oq_mint_worker_running and does not hold the lock. If that
+ *  fails the jobs stay queued, and OQuake_STAR_DrainMintResults retries every frame. */
+static void OQ_MintStartWorker(void) {
+    int started, first_failure = 0;
+#ifdef _WIN32
+    HANDLE h = CreateThread(NULL, 0, OQ_MintWorker, NULL, 0, NULL);
+    started = (h != NULL);
+    if (h) CloseHandle(h);
+#else
+    pthread_t t;
+    started = (pthread_create(&t, NULL, OQ_MintWorker, NULL) == 0);
+    if (started) pthread_detach(t);
+#endif
+    OQ_MintLock();
+    if (!started) {
+        g_oq_mint_worker_running = 0;
+        first_failure = !g_oq_mint_start_failed;
+    }
+    g_oq_mint_start_failed = !started;
+    OQ_MintUnlock();
+    if (first_failure)
+        star_api_log_to_file("[OQuake] Mint queue: could not start the worker thread, retrying every frame");
+}
+
+/** Queue one mint job and start the worker if idle. Returns 0 if the queue is full (caller falls back to pickup-with-mint). */
+static int OQ_MintQueuePush(const char* item_name, const char* description, const char* item_type, const char* provider, const char* send_to, int quantity) {
+    int i, start_worker = 0;
+    oq_mint_job_t* job = NULL;
+#ifdef _WIN32
+    if (!g_oq_mint_lock_ready) return 0;
+#endif
+    OQ_MintLock();
+    for (i = 0; i < OQ_MINT_JOB_MAX; i++)
+        if (g_oq_mint_jobs[i].state == OQ_MINT_FREE) { job = &g_oq_mint_jobs[i]; break; }
+    if (!job || g_oq_mint_stop) {
+        OQ_MintUnlock();
+        return 0;
+    }
+    q_strlcpy(job->item_name, item_name, sizeof(job->item_name));
+    q_strlcpy(job->description, description ? description : "", sizeof(job->description));
+    q_strlcpy(job->item_type, item_type ? item_type : "Item", sizeof(job->item_type));
+    q_strlcpy(job->provider, provider, sizeof(job->provider));
+    q_strlcpy(job->send_to, send_to ? send_to : "", sizeof(job->send_to));
+    job->quantity = quantity;
+    job->seq = g_oq_mint_seq++;
+    job->queued_at = OQ_MintClock();
+    job->state = OQ_MINT_QUEUED;
+    if (!g_oq_mint_worker_running) {
+        g_oq_mint_worker_running = 1;
+        start_worker = 1;
+    }
+    OQ_MintUnlock();
+
+    if (start_worker)
+        OQ_MintStartWorker();
+    return 1;
+}
+
+static void OQ_MintQueueInit(void) {
+#ifdef _WIN32
+    if (!g_oq_mint_lock_ready) {
+        InitializeCriticalSection(&g_oq_mint_lock);
+        InitializeConditionVariable(&g_oq_mint_idle);
+        g_oq_mint_lock_ready = 1;
+    }
+#endif
+    g_oq_mint_stop = 0;
+}
+
+/** Stops the worker after its current batch and waits up to OQ_MINT_SHUTDOWN_WAIT_SEC for it to exit, so
+ *  star_api_cleanup does not run under a mint call. The lock is kept: a worker still minting after the wait needs it. */
+static void OQ_MintQueueShutdown(void) {
+    double deadline;
+    g_oq_mint_stop = 1;
+#ifdef _WIN32
+    if (!g_oq_mint_lock_ready) return;
+#endif
+    OQ_MintLock();
+    deadline = OQ_MintClock() + OQ_MINT_SHUTDOWN_WAIT_SEC;
+    while (g_oq_mint_worker_running) {
+        double left = deadline - OQ_MintClock();
+        if (left <= 0) break;
+#ifdef _WIN32
+        SleepConditionVariableCS(&g_oq_mint_idle, &g_oq_mint_lock, (DWORD)(left * 1000.0) + 1);
+#else
+        {
+            struct timespec ts;
+            clock_gettime(CLOCK_REALTIME, &ts);
+            ts.tv_sec += (time_t)left;
+            ts.tv_nsec += (long)((left - (double)(time_t)left) * 1e9);
+            if (ts.tv_nsec >= 1000000000L) {
+                ts.tv_sec++;
+                ts.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&g_oq_mint_idle, &g_oq_mint_lock, &ts);
+        }
+#endif
+    }
+    if (g_oq_mint_worker_running)
+        printf("OQuake STAR API: mint worker still busy after %.0fs, cleaning up anyway.\n", OQ_MINT_SHUTDOWN_WAIT_SEC);
+    OQ_MintUnlock();
+}
+
+int OQuake_STAR_DrainMintResults(oquake_star_mint_result_t* out, int max_results) {
+    int n = 0, start_worker;
+    if (!out || max_results <= 0) return 0;
+#ifdef _WIN32
+    if (!g_oq_mint_lock_ready) return 0;
+#endif
+    OQ_MintLock();
+    while (n < max_results && g_oq_mint_done_count > 0) {
+        out[n++] = g_oq_mint_done[g_oq_mint_done_head];
+        g_oq_mint_done_head = (g_oq_mint_done_head + 1) % OQ_MINT_DONE_MAX;
+        g_oq_mint_done_count--;
+    }
+    start_worker = g_oq_mint_start_failed && !g_oq_mint_worker_running && !g_oq_mint_stop;
+    if (start_worker)
+        g_oq_mint_worker_running = 1;
+    OQ_MintUnlock();
+    if (start_worker)
+        OQ_MintStartWorker();
+    return n;
+}
+
+/** "star mint stats": per-provider throughput (mints per busy second) and queue-to-result latency. */
+static void OQ_MintQueuePrintStats(void) {
+    oq_mint_provider_stats_t stats[OQ_MINT_PROVIDER_MAX];
+    int count, pending = 0, dropped, i;
+#ifdef _WIN32
+    if (!g_oq_mint_lock_ready) return;
+#endif
+    OQ_MintLock();
+    count = g_oq_mint_stats_count;
+    memcpy(stats, g_oq_mint_stats, sizeof(stats[0]) * (size_t)count);
+    for (i = 0; i < OQ_MINT_JOB_MAX; i++)
+        if (g_oq_mint_jobs[i].state != OQ_MINT_FREE) pending++;
+    dropped = g_oq_mint_done_dropped;
+    OQ_MintUnlock();
+
+    Con_Printf("Mint queue: %d pending, %d results dropped (completion queue full)\n", pending, dropped);
+    if (count == 0) {
+        Con_Printf("  No mints yet.\n");
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        const oq_mint_provider_stats_t* s = &stats[i];
+        int total = s->minted + s->failed;
+        Con_Printf("  %-16s minted %d, failed %d, batches %d, %.2f/s, latency avg %.0f ms max %.0f ms\n",
+            s->provider, s->minted, s->failed, s->batches,
+            s->busy > 0 ? (double)total / s->busy : 0.0,
+            total ? s->latency_sum * 1000.0 / total : 0.0, s->latency_max * 1000.0);
+    }
+}
+
+/* Minimal hooks: C# client does all heavy lifting. Queue a mint job (mint then add) or queue add_item only. */
 static int OQ_AddInventoryUnlockIfMissing(const char* item_name, const char* description, const char* item_type)
 {
     if (!item_name || !item_name[0]) return 0;
@@ -717,9 +1101,10 @@ static int OQ_AddInventoryUnlockIfMissing(const char* item_name, const char* des
     const char* send_to_addr = oquake_star_send_to_address_after_minting.string;
     if (send_to_addr && !send_to_addr[0]) send_to_addr = NULL;
     int do_mint = OQ_DoMintForItemType(item_type);
-    if (do_mint)
-        star_api_queue_pickup_with_mint(item_name, description ? description : "", "Quake", item_type ? item_type : "Item", 1, provider, send_to_addr, 1);
-    else
+    if (do_mint) {
+        if (!OQ_MintQueuePush(item_name, description, item_type, provider, send_to_addr, 1))
+            star_api_queue_pickup_with_mint(item_name, description ? description : "", "Quake", item_type ? item_type : "Item", 1, provider, send_to_addr, 1);
+    } else
         star_api_queue_add_item(item_name, description ? description : "", "Quake", item_type ? item_type : "Item", NULL, 1, 1);
     return 1;
 }
@@ -738,9 +1123,10 @@ static int OQ_AddInventoryEvent(const char* item_prefix, const char* description
     const char* send_to_addr = oquake_star_send_to_address_after_minting.string;
     if (send_to_addr && !send_to_addr[0]) send_to_addr = NULL;
     int do_mint = OQ_DoMintForItemType(item_type);
-    if (do_mint)
-        star_api_queue_pickup_with_mint(item_prefix, description ? description : "", "Quake", item_type ? item_type : "Item", 1, provider, send_to_addr, delta);
-    else
+    if (do_mint) {
+        if (!OQ_MintQueuePush(item_prefix, description, item_type, provider, send_to_addr, delta))
+            star_api_queue_pickup_with_mint(item_prefix, description ? description : "", "Quake", item_type ? item_type : "Item", 1, provider, send_to_addr, delta);
+    } else
         star_api_queue_add_item(item_prefix, description ? description : "", "Quake", item_type ? item_type : "Item", NULL, delta, 1);
     return 1;
 }
@@ -3016,6 +3402,7 @@ static void OQ_StarConfig_f(void) {
 
 void OQuake_STAR_Init(void) {
     star_sync_init();
+    OQ_MintQueueInit();
     star_sync_set_add_item_log_cb(OQ_AddItemLogCb, NULL);
     star_api_result_t result;
     const char* username;
@@ -3690,6 +4077,7 @@ void OQuake_STAR_Init(void) {
 
 void OQuake_STAR_Cleanup(void) {
     OQ_SaveStarConfigToFiles(); /* persist any STAR option changes on exit */
+    OQ_MintQueueShutdown();
     star_sync_cleanup();
     if (g_star_initialized) {
         star_api_cleanup();
@@ -3785,6 +4173,91 @@ void OQuake_STAR_OnMonsterKilled(const char* monster_name) {
     star_api_queue_monster_kill(e->engine_name, e->display_name, e->xp, e->is_boss, do_mint, prov, "OQUAKE");
 }
 
+/* QuakeC event ring: ex_OQuake_Event pushes, OQuake_STAR_PollItems drains once per frame. Fixed size; when full new events are dropped and counted. */
+#define OQ_EVENT_RING_SIZE 64
+#define OQ_EVENT_CLASSNAME_LEN 32
+#define OQ_QC_IT_KEY1 131072  /* defs.qc IT_KEY1 (silver) */
+#define OQ_QC_IT_KEY2 262144  /* defs.qc IT_KEY2 (gold) */
+
+typedef struct oq_event_s {
+    int type;
+    int amount;
+    char classname[OQ_EVENT_CLASSNAME_LEN];
+} oq_event_t;
+
+static oq_event_t g_oq_events[OQ_EVENT_RING_SIZE];
+static int g_oq_event_head = 0;  /* next to drain */
+static int g_oq_event_count = 0;
+static int g_oq_events_dropped = 0;
+/* 1 once the current map's progs announced events in worldspawn; cleared by OQuake_STAR_OnServerSpawn before the next map loads. */
+static int g_oq_progs_use_events = 0;
+
+int OQuake_STAR_ProgsUseEvents(void) {
+    return g_oq_progs_use_events;
+}
+
+void OQuake_STAR_OnServerSpawn(void) {
+    g_oq_progs_use_events = 0;
+    g_oq_event_head = g_oq_event_count = 0;
+}
+
+void OQuake_STAR_PushEvent(int type, const char* classname, int amount) {
+    oq_event_t* ev;
+    if (type == OQUAKE_EVENT_WORLDSPAWN) {
+        g_oq_progs_use_events = 1;
+        g_oq_event_head = g_oq_event_count = 0;
+        return;
+    }
+    if (cls.demoplayback)
+        return;
+    if (g_oq_event_count >= OQ_EVENT_RING_SIZE) {
+        g_oq_events_dropped++;
+        return;
+    }
+    ev = &g_oq_events[(g_oq_event_head + g_oq_event_count) % OQ_EVENT_RING_SIZE];
+    ev->type = type;
+    ev->amount = amount;
+    q_strlcpy(ev->classname, classname ? classname : "", sizeof(ev->classname));
+    g_oq_event_count++;
+}
+
+/* Drain the QuakeC event ring; runs from OQuake_STAR_PollItems so STAR work never happens inside a progs call. */
+static void OQ_DrainEvents(void) {
+    char star_log_buf[256];
+    if (g_oq_events_dropped > 0) {
+        snprintf(star_log_buf, sizeof(star_log_buf), "OQUAKE: event ring full, dropped %d event(s)", g_oq_events_dropped);
+        star_api_log_to_file(star_log_buf);
+        g_oq_events_dropped = 0;
+    }
+    while (g_oq_event_count > 0) {
+        oq_event_t ev = g_oq_events[g_oq_event_head];
+        g_oq_event_head = (g_oq_event_head + 1) % OQ_EVENT_RING_SIZE;
+        g_oq_event_count--;
+        switch (ev.type) {
+        case OQUAKE_EVENT_MONSTER_KILLED:
+            OQuake_STAR_OnMonsterKilled(ev.classname);
+            break;
+        case OQUAKE_EVENT_BOSS_KILLED:
+            OQuake_STAR_OnBossKilled(ev.classname);
+            break;
+        case OQUAKE_EVENT_KEY_PICKUP:
+            if (ev.amount == OQ_QC_IT_KEY1)
+                OQuake_STAR_OnKeyPickup(OQUAKE_ITEM_SILVER_KEY);
+            else if (ev.amount == OQ_QC_IT_KEY2)
+                OQuake_STAR_OnKeyPickup(OQUAKE_ITEM_GOLD_KEY);
+            break;
+        case OQUAKE_EVENT_DOOR_UNLOCKED:
+            if (oquake_star_cross_game_log.value) {
+                snprintf(star_log_buf, sizeof(star_log_buf), "OQUAKE: %s unlocked with local key %d", ev.classname, ev.amount);
+                star_api_log_to_file(star_log_buf);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 /* Hook: called from PF_Remove/PF_sv_makestatic (pr_cmds.c) as fallback. Primary path is SVC_KILLEDMONSTER in PF_sv_WriteByte. Dedupe same entity same frame. */
 void OQuake_STAR_OnEntityFreed(void* ed) {
     const char* ed_classname;
@@ -3793,6 +4266,9 @@ void OQuake_STAR_OnEntityFreed(void* ed) {
 
     if (!ed)
         return;
+    /* Progs report kills through ex_OQuake_Event; skip the classname match on every free. */
+    if (OQuake_STAR_ProgsUseEvents())
+        return;
     ed_classname = PR_GetString(((edict_t*)ed)->v.classname);
     if (!ed_classname || strncmp(ed_classname, "monster_", 8) != 0)
         return;
@@ -4367,6 +4843,89 @@ static void OQ_PollCaptureItemStatsBaseline(
     *poll_prev_valid = 1;
 }
 
+/* ---------------------------------------------------------------------------
+ * Session keeper: star_api.dll only uses its refresh token when a request comes back 401, and it has
+ * no call to refresh early. So, from the JWT's exp claim, the keeper requests the inventory in the
+ * background on the first frame at or after expiry. That 401 and the refresh then run off the game
+ * thread instead of on the first inventory or quest request the player makes. The JWT itself is
+ * only re-read every OQ_SESSION_CHECK_INTERVAL_SEC; whenever it changes, the new tokens go to
+ * oasisstar.json.
+ * --------------------------------------------------------------------------- */
+#define OQ_SESSION_CHECK_INTERVAL_SEC  5.0
+
+static char g_oq_session_jwt[2048] = {0};          /* JWT the current schedule belongs to */
+static time_t g_oq_session_refresh_at = 0;          /* wall-clock refresh time; 0 = nothing scheduled */
+static double g_oq_session_next_check = 0;
+
+/** exp claim (unix seconds) of a JWT, or 0 if it has none. The signature is not checked. */
+static time_t OQ_JwtExpiry(const char* jwt) {
+    char payload[1536];
+    const char* p = jwt ? strchr(jwt, '.') : NULL;
+    const char* end;
+    const char* e;
+    size_t n = 0;
+    unsigned int acc = 0;
+    int bits = 0;
+
+    if (!p) return 0;
+    p++;
+    end = strchr(p, '.');
+    if (!end) return 0;
+    for (; p < end && n + 1 < sizeof(payload); p++) {
+        int v;
+        char c = *p;
+        if (c >= 'A' && c <= 'Z') v = c - 'A';
+        else if (c >= 'a' && c <= 'z') v = c - 'a' + 26;
+        else if (c >= '0' && c <= '9') v = c - '0' + 52;
+        else if (c == '-' || c == '+') v = 62;
+        else if (c == '_' || c == '/') v = 63;
+        else break; /* padding */
+        acc = (acc << 6) | (unsigned int)v;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            payload[n++] = (char)((acc >> bits) & 0xFF);
+        }
+    }
+    payload[n] = '\0';
+    e = strstr(payload, "\"exp\"");
+    if (!e) return 0;
+    e = strchr(e + 5, ':');
+    if (!e) return 0;
+    return (time_t)strtoll(e + 1, NULL, 10);
+}
+
+static void OQ_SessionKeeperPoll(void) {
+    extern double realtime;
+    char jwt[2048] = {0};
+    time_t now;
+
+    if (!g_star_initialized || !g_star_beamed_in)
+        return;
+    now = time(NULL);
+    if (g_oq_session_refresh_at && now >= g_oq_session_refresh_at) {
+        g_oq_session_refresh_at = 0; /* one attempt per token; the next JWT reschedules */
+        star_api_request_inventory_in_background();
+        star_api_log_to_file("[OQuake] Session keeper: JWT expired, background request to trigger token refresh");
+        return;
+    }
+    if (realtime < g_oq_session_next_check)
+        return;
+    g_oq_session_next_check = realtime + OQ_SESSION_CHECK_INTERVAL_SEC;
+    if (star_api_get_current_jwt(jwt, sizeof(jwt)) <= 0 || !jwt[0])
+        return;
+
+    if (strcmp(jwt, g_oq_session_jwt) != 0) {
+        /* New token (beam-in, restore or refresh): schedule its refresh and persist it. */
+        int had_token = g_oq_session_jwt[0] != '\0';
+        time_t exp = OQ_JwtExpiry(jwt);
+        q_strlcpy(g_oq_session_jwt, jwt, sizeof(g_oq_session_jwt));
+        g_oq_session_refresh_at = exp > now ? exp : 0;
+        if (had_token)
+            OQ_SaveStarConfigToFiles(); /* first token is saved by the beam-in / restore path */
+    }
+}
+
 /* Frame-based item/stats poll so pickups are reported even when sbar isn't drawn. Call from Host_Frame. */
 void OQuake_STAR_PollItems(void) {
     extern client_state_t cl;
@@ -4381,6 +4940,10 @@ void OQuake_STAR_PollItems(void) {
 
     /* Run async completions (auth, inventory, use_item) every frame so e.g. "star beamin" finishes even when console is open. */
     star_sync_pump();
+    /* STAR work queued by QuakeC (kills, key pickups, doors) this frame. */
+    OQ_DrainEvents();
+    /* Just after the JWT expires, trigger the DLL's 401 refresh from a background request. */
+    OQ_SessionKeeperPoll();
     /* Keep movement bind capture in sync every frame so closing a popup still restores WASD if the HUD draw path did not run (Linux / loading / menu). */
     OQ_UpdatePopupInputCapture();
 
@@ -4444,7 +5007,19 @@ void OQuake_STAR_PollItems(void) {
         OQ_SaveStarConfigToFiles();
     }
 
-    /* Show mint result in console when background pickup-with-mint completes (NFT ID + Hash). */
+    /* Show every finished mint from the mint queue (NFT ID + Hash), drained in one call. */
+    {
+        oquake_star_mint_result_t mints[OQ_MINT_DONE_MAX];
+        int n = OQuake_STAR_DrainMintResults(mints, OQ_MINT_DONE_MAX);
+        int i;
+        for (i = 0; i < n; i++) {
+            if (mints[i].result == STAR_API_SUCCESS)
+                Con_Printf("NFT minted: %s | ID: %s | Hash: %s\n", mints[i].item_name, mints[i].nft_id, mints[i].hash[0] ? mints[i].hash : "(none)");
+            else
+                Con_Printf("NFT mint failed (%s): %s - %s\n", mints[i].provider, mints[i].item_name, mints[i].error);
+        }
+    }
+    /* Monster-kill mints and queue-full fallbacks still go through the DLL's single last-result slot. */
     {
         char item_buf[256] = {0}, nft_buf[128] = {0}, hash_buf[256] = {0};
         if (star_api_consume_last_mint_result(item_buf, sizeof(item_buf), nft_buf, sizeof(nft_buf), hash_buf, sizeof(hash_buf)))
@@ -4680,6 +5255,7 @@ void OQuake_STAR_Console_f(void) {
         Con_Printf("  star stack <armor|weapons|powerups|keys|sigils> <0|1> - Stack (1) or unlock (0)\n");
         Con_Printf("  star mint <armor|weapons|powerups|keys> <0|1> - Mint NFT when collecting (1=on, 0=off)\n");
         Con_Printf("  star mint monster <name> <0|1> - Mint NFT when killing monster (e.g. oquake_ogre)\n");
+        Con_Printf("  star mint stats    - Mint queue throughput and latency per provider\n");
         Con_Printf("  star nftprovider <name> - Set NFT mint provider (e.g. SolanaOASIS)\n");
         Con_Printf("  star seturl <url>       - Set STAR API URL (saved to config)\n");
         Con_Printf("  star setoasisurl <url>  - Set OASIS API URL (saved to config)\n");
@@ -4896,7 +5472,9 @@ void OQuake_STAR_Console_f(void) {
 
         if (star_initialized() && !runtime_user) { Con_Printf("Already logged in. Use 'star beamout' first.\n"); return; }
         if (star_initialized() && runtime_user) {
+        OQ_MintQueueShutdown();
         star_api_cleanup();
+        OQ_MintQueueInit();
         g_star_initialized = 0;
         g_star_beamed_in = 0;
         OQ_ResetCrossGameBeamTransferState();
@@ -5044,7 +5622,9 @@ void OQuake_STAR_Console_f(void) {
     }
     if (strcmp(sub, "beamout") == 0) {
         if (!star_initialized()) { Con_Printf("Not logged in. Use 'star beamin' to log in.\n"); return; }
+        OQ_MintQueueShutdown();
         star_api_cleanup();
+        OQ_MintQueueInit();
         g_star_initialized = 0;
         g_star_beamed_in = 0;
         OQ_ResetCrossGameBeamTransferState();
@@ -5140,9 +5720,14 @@ void OQuake_STAR_Console_f(void) {
             Con_Printf("Mint NFT for %s (mint_monster_%s) set to %s. Config saved.\n", chosen->display_name, chosen->config_key, on ? "on" : "off");
             return;
         }
+        if (argc >= 3 && strcmp(Cmd_Argv(2), "stats") == 0) {
+            OQ_MintQueuePrintStats();
+            return;
+        }
         if (argc < 4) {
             Con_Printf("Usage: star mint <armor|weapons|powerups|keys> <0|1>\n");
             Con_Printf("       star mint monster <name> <0|1>\n");
+            Con_Printf("       star mint stats\n");
             Con_Printf("  1 = mint NFT when collecting/killing that category, 0 = off.\n");
             return;
         }
@@ -21,6 +21,13 @@ extern "C" {
 #define OQUAKE_ITEM_SILVER_KEY "silver_key"
 #define OQUAKE_ITEM_GOLD_KEY   "gold_key"
 
+/* Event types pushed by QuakeC through ex_OQuake_Event (must match OQ_EVENT_* in defs.qc). */
+#define OQUAKE_EVENT_WORLDSPAWN     0
+#define OQUAKE_EVENT_MONSTER_KILLED 1
+#define OQUAKE_EVENT_BOSS_KILLED    2
+#define OQUAKE_EVENT_KEY_PICKUP     3
+#define OQUAKE_EVENT_DOOR_UNLOCKED  4
+
 typedef struct cb_context_s cb_context_t;
 
 void OQuake_STAR_Init(void);
@@ -61,10 +68,28 @@ void OQuake_STAR_OnMonsterKilled(const char* monster_name);
 void OQuake_STAR_OnBossKilled(const char* boss_name);
 /** Safe hook for ED_Free: call from engine before ED_Free(ent). Only reports monster kills when sv.active && !demoplayback; no PR_GetString in engine. Pass entity pointer (edict_t*). */
 void OQuake_STAR_OnEntityFreed(void* ed);
+/** Backing call for the ex_OQuake_Event builtin: copies (type, subject classname, amount) into a fixed ring drained by OQuake_STAR_PollItems. Cheap enough to call from any QuakeC path. */
+void OQuake_STAR_PushEvent(int type, const char* classname, int amount);
+/** Call from SV_SpawnServer before the map's entities are loaded (before worldspawn runs). Forgets the previous map's event announcement and any undrained events. */
+void OQuake_STAR_OnServerSpawn(void);
+/** Returns 1 once the running progs announced ex_OQuake_Event in worldspawn. Engine kill hooks (SVC_KILLEDMONSTER, OnEntityFreed) should skip their own reporting then, or kills are counted twice. */
+int OQuake_STAR_ProgsUseEvents(void);
 /** Call from engine or QuakeC when the player touches a health/armor/ammo pickup but the engine does NOT apply it (e.g. player already at max). Same as ODOOM: only add to STAR when the item would normally be left on the floor. Engine should remove the entity after calling so the item is not left on the floor. */
 void OQuake_STAR_OnPickupLeftOnFloor(const char* item_name, const char* item_type, int quantity, const char* optional_description);
 /** Call from engine before running the touch function for (e1, e2). Returns 0 = no intercept; 1 = intercept, free e1 (first arg) and skip touch; 2 = intercept, free e2 (second arg) and skip touch. Engine must handle both orderings: (player, item) and (item, player). When (player, item), return 2 so caller frees e2 (the item) and must not run item's touch. */
 int OQuake_STAR_InterceptTouchPickupAtMax(void* item_edict, void* player_edict);
+/** One finished mint from the mint queue. latency is seconds from queueing to the mint result. */
+typedef struct oquake_star_mint_result_s {
+    char item_name[256];
+    char provider[64];
+    char nft_id[128];
+    char hash[128];
+    char error[256];
+    star_api_result_t result;
+    double latency;
+} oquake_star_mint_result_t;
+/** Copy up to max_results finished mints (oldest first) into out and remove them from the completion queue. Returns how many were copied. OQuake_STAR_PollItems already drains it every frame and prints the results. */
+int OQuake_STAR_DrainMintResults(oquake_star_mint_result_t* out, int max_results);
 /** Returns 1 if the quest popup (Q key) is open, 0 otherwise. Engine should call this when building the movement/usercmd: if it returns 1, do not apply movement (forwardmove/sidemove/upmove and optionally +left/+right/+lookup/+lookdown) so the player does not move while the popup is open, and keys are never cleared so movement works immediately after closing. Declare in header so engine can call it. */
 int OQuake_STAR_IsQuestPopupOpen(void);
 /** Returns 1 if the inventory popup (I key) is open, 0 otherwise. Engine should use the same movement/view blocking as for the quest popup when either popup is open. */
@@ -4,6 +4,10 @@
  * Compiles on Windows (Win32 threads) and elsewhere (pthreads).
  */
 
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L  /* nanosleep under -std=c99 */
+#endif
+
 #include "star_sync.h"
 #include <string.h>
 #include <stdlib.h>
@@ -28,6 +32,7 @@ void star_api_queue_quest_level_time(const char* game_source, int level_elapsed_
 #include <windows.h>
 #else
 #include <pthread.h>
+#include <time.h>
 #endif
 
 /* Safe copy; always null-terminates, truncates to size-1 */
@@ -247,8 +252,26 @@ int star_sync_auth_in_progress(void) {
  * --------------------------------------------------------------------------- */
 #define INV_ERROR_SIZE 256
 
-static star_sync_local_item_t* g_inv_local_items = NULL;
-static int g_inv_local_count = 0;
+/* The sync layer's own copy of the caller's unsynced local items. Strings are packed right after
+ * the entry array in one buffer that is kept and reused by later refreshes. Only the worker
+ * touches the entries while a refresh is in progress; once it is done they are the completion
+ * record that star_sync_inventory_get_synced reads, until the next refresh starts. */
+typedef struct {
+    const char* name;
+    const char* description;
+    const char* game_source;
+    const char* item_type;
+    const char* nft_id;
+    int index;   /* position in the caller's array */
+    int synced;
+} inv_item_t;
+
+static void* g_inv_arena = NULL;
+static size_t g_inv_arena_size = 0;
+static inv_item_t* g_inv_items = NULL;
+static int g_inv_item_count = 0;
+static int g_inv_handle = 0;       /* handle of the latest refresh */
+static int g_inv_next_handle = 0;
 static char g_inv_default_game_source[64] = {0};
 static int g_inv_in_progress = 0;
 static int g_inv_has_result = 0;
@@ -279,6 +302,50 @@ static pthread_t g_inv_thread = 0;
 
 static int g_sync_initialized = 0;
 
+/* Single-item sync requests. Slots are only written by the main thread while free and only by the
+ * worker while running; a finished slot stays put until star_sync_pump reports it. */
+#define SINGLE_QUEUE_SIZE 32
+#define SINGLE_ERROR_SIZE 256
+#define SINGLE_CALLBACKS_MAX 4  /* callers that can share one request */
+
+enum { SINGLE_FREE, SINGLE_QUEUED, SINGLE_RUNNING, SINGLE_DONE };
+
+/* A blocking star_sync_single_item caller. Lives on its stack; the worker fills it under
+ * g_single_lock when the request finishes, so it does not depend on the slot outliving the pump. */
+typedef struct single_waiter {
+    int done;
+    star_api_result_t result;
+    struct single_waiter* next;
+} single_waiter_t;
+
+typedef struct {
+    int state;
+    int id;
+    char name[256];
+    char description[512];
+    char game_source[64];
+    char item_type[64];
+    char nft_id[128];
+    int added;   /* worker queued an add_item for it */
+    star_api_result_t result;
+    char error[SINGLE_ERROR_SIZE];
+    int callback_count;
+    star_sync_single_item_on_done_fn on_done[SINGLE_CALLBACKS_MAX];
+    void* on_done_user[SINGLE_CALLBACKS_MAX];
+    single_waiter_t* waiters;
+} single_req_t;
+
+static single_req_t g_single_reqs[SINGLE_QUEUE_SIZE];
+static int g_single_next_id = 0;
+static int g_single_worker_running = 0;
+#ifdef _WIN32
+static CRITICAL_SECTION g_single_lock;
+#else
+static pthread_mutex_t g_single_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void single_item_pump(void);
+
 #ifdef _WIN32
 static CRITICAL_SECTION g_send_lock;
 static HANDLE g_send_thread = NULL;
@@ -600,6 +667,7 @@ void star_sync_init(void) {
     InitializeCriticalSection(&g_inv_lock);
     InitializeCriticalSection(&g_send_lock);
     InitializeCriticalSection(&g_use_lock);
+    InitializeCriticalSection(&g_single_lock);
 #endif
     g_sync_initialized = 1;
 }
@@ -607,7 +675,15 @@ void star_sync_init(void) {
 void star_sync_cleanup(void) {
     if (!g_sync_initialized) return;
     star_sync_inventory_clear_result();
+    if (!star_sync_inventory_in_progress()) {
+        free(g_inv_arena);
+        g_inv_arena = NULL;
+        g_inv_arena_size = 0;
+        g_inv_items = NULL;
+        g_inv_item_count = 0;
+    }
 #ifdef _WIN32
+    DeleteCriticalSection(&g_single_lock);
     DeleteCriticalSection(&g_use_lock);
     DeleteCriticalSection(&g_send_lock);
     DeleteCriticalSection(&g_inv_lock);
@@ -725,6 +801,76 @@ void star_sync_pump(void) {
 #endif
     if (use_fn)
         use_fn(use_ud);
+
+    single_item_pump();
+}
+
+/* Open-addressing set of item names (pointers are borrowed, not copied). Used to diff the local
+ * items against one inventory fetch instead of asking has_item for each of them. */
+typedef struct {
+    const char** slots;
+    size_t mask;
+} name_set_t;
+
+static size_t name_hash(const char* s) {
+    size_t h = 2166136261u; /* FNV-1a */
+    while (*s) {
+        h ^= (unsigned char)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Sized for at most 'count' names at under half load. Returns 0 if out of memory. */
+static int name_set_init(name_set_t* set, size_t count) {
+    size_t size = 16;
+    while (size < count * 2)
+        size <<= 1;
+    set->slots = (const char**)calloc(size, sizeof(const char*));
+    set->mask = size - 1;
+    return set->slots != NULL;
+}
+
+static void name_set_free(name_set_t* set) {
+    free((void*)set->slots);
+    set->slots = NULL;
+}
+
+/* Adds name unless already present. Returns 1 if it was added, 0 if it was there. */
+static int name_set_add(name_set_t* set, const char* name) {
+    size_t i = name_hash(name) & set->mask;
+    while (set->slots[i]) {
+        if (strcmp(set->slots[i], name) == 0)
+            return 0;
+        i = (i + 1) & set->mask;
+    }
+    set->slots[i] = name;
+    return 1;
+}
+
+/* Stack events are named <base>_NNNNNN (e.g. Shells_000001); base_out gets <base>. */
+static int is_stack_event_name(const char* n, char* base_out, size_t base_size) {
+    size_t len = strlen(n);
+    size_t base_len;
+    int j;
+    if (len < 8 || n[len - 7] != '_') return 0;
+    for (j = 0; j < 6; j++)
+        if (n[len - 6 + j] < '0' || n[len - 6 + j] > '9') return 0;
+    base_len = len - 7;
+    if (base_len >= base_size) base_len = base_size - 1;
+    memcpy(base_out, n, base_len);
+    base_out[base_len] = '\0';
+    return 1;
+}
+
+static void queue_local_item(const inv_item_t* item, const char* name, const char* default_src) {
+    const char* nft = (item->nft_id[0] != '\0') ? item->nft_id : NULL;
+    star_api_queue_add_item(
+        name,
+        item->description,
+        item->game_source[0] ? item->game_source : default_src,
+        item->item_type[0] ? item->item_type : "KeyItem",
+        nft, 1, 1);
 }
 
 #ifdef _WIN32
@@ -732,7 +878,7 @@ static DWORD WINAPI inventory_thread_proc(LPVOID param) {
 #else
 static void* inventory_thread_proc(void* param) {
 #endif
-    star_sync_local_item_t* local;
+    inv_item_t* local;
     int local_count;
     char default_src[64];
     star_item_list_t* list = NULL;
@@ -748,8 +894,8 @@ static void* inventory_thread_proc(void* param) {
 #ifndef _WIN32
     pthread_mutex_lock(&g_inv_lock);
 #endif
-    local = g_inv_local_items;
-    local_count = g_inv_local_count;
+    local = g_inv_items;
+    local_count = g_inv_item_count;
     str_copy(default_src, g_inv_default_game_source, sizeof(default_src));
 #ifdef _WIN32
     LeaveCriticalSection(&g_inv_lock);
@@ -757,68 +903,84 @@ static void* inventory_thread_proc(void* param) {
     pthread_mutex_unlock(&g_inv_lock);
 #endif
 
-    /* Queue each add then flush (batching). Stack: name ends with _NNNNNN (e.g. Shells_000001) – send base name, API increments Quantity. Unlock: has_item first, queue add only if not present. */
+    /* Stack events (<base>_NNNNNN) are always queued under the base name so the API increments
+     * Quantity. Unlocks are only queued if missing: the remote inventory is fetched once, its names
+     * go into a set, and everything not in it is queued and flushed as one batch. The inventory is
+     * fetched again at the end only if something was added. If the first fetch fails, fall back
+     * to asking has_item per item. */
     g_inv_add_item_error[0] = '\0';
     if (local && local_count > 0 && default_src[0]) {
+        name_set_t remote;
+        int have_remote = 0;
+        int queued = 0;
         int i;
+        int need_check = 0;
+
         for (i = 0; i < local_count; i++) {
+            char base_name[128];
+            if (!local[i].synced && !is_stack_event_name(local[i].name, base_name, sizeof(base_name))) {
+                need_check = 1;
+                break;
+            }
+        }
+        if (need_check && star_api_get_inventory(&list) == STAR_API_SUCCESS && list) {
+            if (name_set_init(&remote, list->count + (size_t)local_count)) {
+                size_t k;
+                for (k = 0; k < list->count; k++)
+                    name_set_add(&remote, list->items[k].name);
+                have_remote = 1;
+            }
+        }
+
+        for (i = 0; i < local_count; i++) {
+            char base_name[128];
+            const char* queued_name = NULL;
             if (local[i].synced) continue;
-            {
-                const char* n = local[i].name;
-                size_t len = strlen(n);
-                int is_stack_event = 0;
-                if (len >= 8 && n[len - 7] == '_') {
-                    int j;
-                    is_stack_event = 1;
-                    for (j = 0; j < 6; j++)
-                        if (n[len - 6 + j] < '0' || n[len - 6 + j] > '9') { is_stack_event = 0; break; }
-                }
-                if (is_stack_event) {
-                    /* Send base name (no _NNNNNN) so API increments Quantity on existing item. */
-                    char base_name[128];
-                    size_t base_len = len >= 8 ? (size_t)(len - 7) : len;
-                    if (base_len >= sizeof(base_name)) base_len = sizeof(base_name) - 1;
-                    memcpy(base_name, n, base_len);
-                    base_name[base_len] = '\0';
-                    const char* nft = (local[i].nft_id[0] != '\0') ? local[i].nft_id : NULL;
-                    star_api_queue_add_item(
-                        base_name,
-                        local[i].description,
-                        local[i].game_source[0] ? local[i].game_source : default_src,
-                        local[i].item_type[0] ? local[i].item_type : "KeyItem",
-                        nft, 1, 1);
-                    if (logged_count < ADD_ITEM_LOG_NAMES_MAX)
-                        str_copy(logged_names[logged_count++], base_name, ADD_ITEM_LOG_NAME_SIZE);
-                } else {
-                    if (!star_api_has_item(local[i].name)) {
-                        const char* nft = (local[i].nft_id[0] != '\0') ? local[i].nft_id : NULL;
-                        star_api_queue_add_item(
-                            local[i].name,
-                            local[i].description,
-                            local[i].game_source[0] ? local[i].game_source : default_src,
-                            local[i].item_type[0] ? local[i].item_type : "KeyItem",
-                            nft, 1, 1);
-                        if (logged_count < ADD_ITEM_LOG_NAMES_MAX)
-                            str_copy(logged_names[logged_count++], local[i].name, ADD_ITEM_LOG_NAME_SIZE);
-                    }
-                }
-                local[i].synced = 1;
+            if (is_stack_event_name(local[i].name, base_name, sizeof(base_name))) {
+                queued_name = base_name;
+            } else if (have_remote) {
+                /* Adding to the set also drops duplicates within this batch. */
+                if (name_set_add(&remote, local[i].name))
+                    queued_name = local[i].name;
+            } else if (!star_api_has_item(local[i].name)) {
+                queued_name = local[i].name;
+            }
+            if (queued_name) {
+                queue_local_item(&local[i], queued_name, default_src);
+                queued++;
+                if (logged_count < ADD_ITEM_LOG_NAMES_MAX)
+                    str_copy(logged_names[logged_count++], queued_name, ADD_ITEM_LOG_NAME_SIZE);
             }
+            local[i].synced = 1;
         }
-        star_api_result_t flush_res = star_api_flush_add_item_jobs();
-        if (flush_res != STAR_API_SUCCESS && g_inv_add_item_error[0] == '\0') {
-            const char* flush_err = star_api_get_last_error();
-            str_copy(g_inv_add_item_error, flush_err ? flush_err : "flush add_item jobs failed", sizeof(g_inv_add_item_error));
+        if (have_remote)
+            name_set_free(&remote);
+
+        if (queued > 0) {
+            star_api_result_t flush_res = star_api_flush_add_item_jobs();
+            if (flush_res != STAR_API_SUCCESS && g_inv_add_item_error[0] == '\0') {
+                const char* flush_err = star_api_get_last_error();
+                str_copy(g_inv_add_item_error, flush_err ? flush_err : "flush add_item jobs failed", sizeof(g_inv_add_item_error));
+            }
+            /* The fetched list is stale now. */
+            if (list) {
+                star_api_free_item_list(list);
+                list = NULL;
+            }
         }
     }
 
-    result = star_api_get_inventory(&list);
-    if (result != STAR_API_SUCCESS) {
-        err = star_api_get_last_error();
-        if (!err || !err[0]) err = "Unknown error";
-    } else if (!list) {
-        result = STAR_API_ERROR_API_ERROR;
-        err = "Inventory API returned success but no data";
+    if (list) {
+        result = STAR_API_SUCCESS; /* nothing was added since the fetch above */
+    } else {
+        result = star_api_get_inventory(&list);
+        if (result != STAR_API_SUCCESS) {
+            err = star_api_get_last_error();
+            if (!err || !err[0]) err = "Unknown error";
+        } else if (!list) {
+            result = STAR_API_ERROR_API_ERROR;
+            err = "Inventory API returned success but no data";
+        }
     }
 
 #ifdef _WIN32
@@ -878,11 +1040,82 @@ void star_sync_inventory_deliver_result(star_item_list_t* list, star_api_result_
 #endif
 }
 
-void star_sync_inventory_start(star_sync_local_item_t* local_items,
+/* Copies the unsynced entries of local_items into g_inv_arena. Call with g_inv_lock held and no
+ * refresh in progress. Returns 0 if out of memory. */
+static int inv_copy_local_items(const star_sync_local_item_t* local_items, int local_count) {
+    static const size_t field_sizes[5] = {
+        sizeof(((star_sync_local_item_t*)0)->name),
+        sizeof(((star_sync_local_item_t*)0)->description),
+        sizeof(((star_sync_local_item_t*)0)->game_source),
+        sizeof(((star_sync_local_item_t*)0)->item_type),
+        sizeof(((star_sync_local_item_t*)0)->nft_id)
+    };
+    size_t need;
+    char* strings;
+    int count = 0;
+    int i;
+
+    g_inv_items = NULL;
+    g_inv_item_count = 0;
+    if (!local_items || local_count <= 0)
+        return 1;
+
+    need = 0;
+    for (i = 0; i < local_count; i++) {
+        const star_sync_local_item_t* it = &local_items[i];
+        if (it->synced) continue;
+        need += sizeof(inv_item_t);
+        need += strnlen(it->name, field_sizes[0] - 1) + 1;
+        need += strnlen(it->description, field_sizes[1] - 1) + 1;
+        need += strnlen(it->game_source, field_sizes[2] - 1) + 1;
+        need += strnlen(it->item_type, field_sizes[3] - 1) + 1;
+        need += strnlen(it->nft_id, field_sizes[4] - 1) + 1;
+        count++;
+    }
+    if (count == 0)
+        return 1;
+    if (need > g_inv_arena_size) {
+        void* grown = realloc(g_inv_arena, need);
+        if (!grown)
+            return 0;
+        g_inv_arena = grown;
+        g_inv_arena_size = need;
+    }
+
+    g_inv_items = (inv_item_t*)g_inv_arena;
+    strings = (char*)(g_inv_items + count);
+    for (i = 0; i < local_count; i++) {
+        const star_sync_local_item_t* it = &local_items[i];
+        const char* src[5];
+        const char** dst[5];
+        inv_item_t* e;
+        int f;
+        if (it->synced) continue;
+        e = &g_inv_items[g_inv_item_count++];
+        src[0] = it->name;        dst[0] = &e->name;
+        src[1] = it->description; dst[1] = &e->description;
+        src[2] = it->game_source; dst[2] = &e->game_source;
+        src[3] = it->item_type;   dst[3] = &e->item_type;
+        src[4] = it->nft_id;      dst[4] = &e->nft_id;
+        for (f = 0; f < 5; f++) {
+            size_t n = strnlen(src[f], field_sizes[f] - 1);
+            memcpy(strings, src[f], n);
+            strings[n] = '\0';
+            *dst[f] = strings;
+            strings += n + 1;
+        }
+        e->index = i;
+        e->synced = 0;
+    }
+    return 1;
+}
+
+int star_sync_inventory_start_handle(const star_sync_local_item_t* local_items,
     int local_count,
     const char* default_game_source,
     star_sync_inventory_on_done_fn on_done,
     void* on_done_user) {
+    int handle;
 #ifdef _WIN32
     EnterCriticalSection(&g_inv_lock);
 #else
@@ -890,19 +1123,25 @@ void star_sync_inventory_start(star_sync_local_item_t* local_items,
 #endif
     if (g_inv_in_progress) {
 #ifdef _WIN32
-    LeaveCriticalSection(&g_inv_lock);
+        LeaveCriticalSection(&g_inv_lock);
 #else
-    pthread_mutex_unlock(&g_inv_lock);
+        pthread_mutex_unlock(&g_inv_lock);
 #endif
-        return;
+        return 0;
+    }
+    if (!inv_copy_local_items(local_items, local_count)) {
+        /* Out of memory: still refresh the inventory, just without syncing local items. */
+        g_inv_items = NULL;
+        g_inv_item_count = 0;
     }
+    if (++g_inv_next_handle <= 0)
+        g_inv_next_handle = 1;
+    handle = g_inv_handle = g_inv_next_handle;
     if (g_inv_list) {
         star_api_free_item_list(g_inv_list);
         g_inv_list = NULL;
     }
     g_inv_has_result = 0;
-    g_inv_local_items = local_items;
-    g_inv_local_count = local_count < 0 ? 0 : local_count;
     str_copy(g_inv_default_game_source, default_game_source ? default_game_source : "", sizeof(g_inv_default_game_source));
     g_inv_on_done = on_done;
     g_inv_on_done_user = on_done_user;
@@ -912,8 +1151,43 @@ void star_sync_inventory_start(star_sync_local_item_t* local_items,
     g_inv_thread = CreateThread(NULL, 0, inventory_thread_proc, NULL, 0, NULL);
 #else
     pthread_mutex_unlock(&g_inv_lock);
-    pthread_create(&g_inv_thread, NULL, inventory_thread_proc, NULL);
+    if (pthread_create(&g_inv_thread, NULL, inventory_thread_proc, NULL) == 0)
+        pthread_detach(g_inv_thread); /* completion is reported through g_inv_has_result, never joined */
 #endif
+    return handle;
+}
+
+void star_sync_inventory_start(star_sync_local_item_t* local_items,
+    int local_count,
+    const char* default_game_source,
+    star_sync_inventory_on_done_fn on_done,
+    void* on_done_user) {
+    star_sync_inventory_start_handle(local_items, local_count, default_game_source, on_done, on_done_user);
+}
+
+int star_sync_inventory_get_synced(int handle, int* indices_out, int max_indices) {
+    int count = -1;
+    int i;
+#ifdef _WIN32
+    EnterCriticalSection(&g_inv_lock);
+#else
+    pthread_mutex_lock(&g_inv_lock);
+#endif
+    if (handle && handle == g_inv_handle && !g_inv_in_progress) {
+        count = 0;
+        for (i = 0; i < g_inv_item_count; i++) {
+            if (!g_inv_items[i].synced) continue;
+            if (indices_out && count < max_indices)
+                indices_out[count] = g_inv_items[i].index;
+            count++;
+        }
+    }
+#ifdef _WIN32
+    LeaveCriticalSection(&g_inv_lock);
+#else
+    pthread_mutex_unlock(&g_inv_lock);
+#endif
+    return count;
 }
 
 int star_sync_inventory_poll(void) {
@@ -1009,21 +1283,306 @@ int star_sync_inventory_in_progress(void) {
     return in_progress;
 }
 
+static void single_lock(void) {
+#ifdef _WIN32
+    EnterCriticalSection(&g_single_lock);
+#else
+    pthread_mutex_lock(&g_single_lock);
+#endif
+}
+
+static void single_unlock(void) {
+#ifdef _WIN32
+    LeaveCriticalSection(&g_single_lock);
+#else
+    pthread_mutex_unlock(&g_single_lock);
+#endif
+}
+
+/* Takes every queued request, checks which are missing and adds them with one flush; repeats until
+ * the queue is empty. */
+#ifdef _WIN32
+static DWORD WINAPI single_item_thread_proc(LPVOID param) {
+#else
+static void* single_item_thread_proc(void* param) {
+#endif
+    (void)param;
+    for (;;) {
+        single_req_t* batch[SINGLE_QUEUE_SIZE];
+        int count = 0;
+        int queued = 0;
+        int i;
+        star_api_result_t flush_res = STAR_API_SUCCESS;
+        const char* flush_err = "";
+
+        single_lock();
+        for (i = 0; i < SINGLE_QUEUE_SIZE; i++) {
+            if (g_single_reqs[i].state == SINGLE_QUEUED) {
+                g_single_reqs[i].state = SINGLE_RUNNING;
+                batch[count++] = &g_single_reqs[i];
+            }
+        }
+        if (count == 0) {
+            g_single_worker_running = 0;
+            single_unlock();
+            break;
+        }
+        single_unlock();
+
+        /* Running slots are ours until marked done. */
+        for (i = 0; i < count; i++) {
+            single_req_t* r = batch[i];
+            r->added = 0;
+            if (star_api_has_item(r->name))
+                continue;
+            star_api_queue_add_item(r->name, r->description, r->game_source, r->item_type, r->nft_id[0] ? r->nft_id : NULL, 1, 1);
+            r->added = 1;
+            queued++;
+        }
+        if (queued > 0) {
+            flush_res = star_api_flush_add_item_jobs();
+            if (flush_res != STAR_API_SUCCESS) {
+                flush_err = star_api_get_last_error();
+                if (!flush_err || !flush_err[0]) flush_err = "flush add_item jobs failed";
+            }
+        }
+        for (i = 0; i < count; i++) {
+            single_req_t* r = batch[i];
+            r->result = r->added ? flush_res : STAR_API_SUCCESS;
+            str_copy(r->error, r->added ? flush_err : "", sizeof(r->error));
+        }
+
+        single_lock();
+        for (i = 0; i < count; i++) {
+            single_waiter_t* w;
+            for (w = batch[i]->waiters; w; w = w->next) {
+                w->result = batch[i]->result;
+                w->done = 1;
+            }
+            batch[i]->waiters = NULL;
+            batch[i]->state = SINGLE_DONE;
+        }
+        single_unlock();
+    }
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/* Queues (or merges) a request. on_done and waiter are both optional. Returns the request id, or 0 if
+ * name is empty, the queue is full, or on_done would be one callback too many for a merged request. */
+static int single_item_enqueue(const char* name,
+    const char* description,
+    const char* game_source,
+    const char* item_type,
+    const char* nft_id,
+    star_sync_single_item_on_done_fn on_done,
+    void* on_done_user,
+    single_waiter_t* waiter) {
+    single_req_t* slot = NULL;
+    int start_worker = 0;
+    int id = 0;
+    int i;
+
+    if (!name || !name[0]) return 0;
+    single_lock();
+    for (i = 0; i < SINGLE_QUEUE_SIZE; i++) {
+        single_req_t* r = &g_single_reqs[i];
+        if (r->state == SINGLE_FREE) {
+            if (!slot) slot = r;
+        } else if (r->state != SINGLE_DONE && strcmp(r->name, name) == 0) {
+            /* Already queued or in flight: share it, and report to every caller. */
+            if (on_done) {
+                if (r->callback_count >= SINGLE_CALLBACKS_MAX) {
+                    single_unlock();
+                    return 0;
+                }
+                r->on_done[r->callback_count] = on_done;
+                r->on_done_user[r->callback_count] = on_done_user;
+                r->callback_count++;
+            }
+            if (waiter) {
+                waiter->next = r->waiters;
+                r->waiters = waiter;
+            }
+            id = r->id;
+            single_unlock();
+            return id;
+        }
+    }
+    if (slot) {
+        if (++g_single_next_id <= 0)
+            g_single_next_id = 1;
+        id = slot->id = g_single_next_id;
+        str_copy(slot->name, name, sizeof(slot->name));
+        str_copy(slot->description, description ? description : "", sizeof(slot->description));
+        str_copy(slot->game_source, game_source ? game_source : "", sizeof(slot->game_source));
+        str_copy(slot->item_type, item_type ? item_type : "KeyItem", sizeof(slot->item_type));
+        str_copy(slot->nft_id, nft_id ? nft_id : "", sizeof(slot->nft_id));
+        slot->callback_count = 0;
+        if (on_done) {
+            slot->on_done[0] = on_done;
+            slot->on_done_user[0] = on_done_user;
+            slot->callback_count = 1;
+        }
+        slot->waiters = NULL;
+        if (waiter) {
+            waiter->next = NULL;
+            slot->waiters = waiter;
+        }
+        slot->state = SINGLE_QUEUED;
+        if (!g_single_worker_running) {
+            g_single_worker_running = 1;
+            start_worker = 1;
+        }
+    }
+    single_unlock();
+
+    if (start_worker) {
+#ifdef _WIN32
+        HANDLE h = CreateThread(NULL, 0, single_item_thread_proc, NULL, 0, NULL);
+        if (h) CloseHandle(h);
+        else start_worker = 0;
+#else
+        pthread_t t;
+        if (pthread_create(&t, NULL, single_item_thread_proc, NULL) == 0) pthread_detach(t);
+        else start_worker = 0;
+#endif
+        if (!start_worker) {
+            /* No worker: run it on the next start instead of leaving it stuck. */
+            single_lock();
+            g_single_worker_running = 0;
+            single_unlock();
+        }
+    }
+    return id;
+}
+
+int star_sync_single_item_start(const char* name,
+    const char* description,
+    const char* game_source,
+    const char* item_type,
+    const char* nft_id,
+    star_sync_single_item_on_done_fn on_done,
+    void* on_done_user) {
+    return single_item_enqueue(name, description, game_source, item_type, nft_id, on_done, on_done_user, NULL);
+}
+
+int star_sync_single_item_pending(const char* name) {
+    int pending = 0;
+    int i;
+    if (!name) return 0;
+    single_lock();
+    for (i = 0; i < SINGLE_QUEUE_SIZE; i++) {
+        if (g_single_reqs[i].state != SINGLE_FREE && g_single_reqs[i].state != SINGLE_DONE
+            && strcmp(g_single_reqs[i].name, name) == 0) {
+            pending = 1;
+            break;
+        }
+    }
+    single_unlock();
+    return pending;
+}
+
+/* Reports finished single-item requests from star_sync_pump. */
+static void single_item_pump(void) {
+    struct {
+        char name[256];
+        star_api_result_t result;
+        char error[SINGLE_ERROR_SIZE];
+        int added;
+        int callback_count;
+        star_sync_single_item_on_done_fn on_done[SINGLE_CALLBACKS_MAX];
+        void* on_done_user[SINGLE_CALLBACKS_MAX];
+    } done[SINGLE_QUEUE_SIZE];
+    int count = 0;
+    int i, k;
+
+    single_lock();
+    for (i = 0; i < SINGLE_QUEUE_SIZE; i++) {
+        single_req_t* r = &g_single_reqs[i];
+        if (r->state != SINGLE_DONE) continue;
+        str_copy(done[count].name, r->name, sizeof(done[count].name));
+        done[count].result = r->result;
+        str_copy(done[count].error, r->error, sizeof(done[count].error));
+        done[count].added = r->added;
+        done[count].callback_count = r->callback_count;
+        for (k = 0; k < r->callback_count; k++) {
+            done[count].on_done[k] = r->on_done[k];
+            done[count].on_done_user[k] = r->on_done_user[k];
+        }
+        count++;
+        r->state = SINGLE_FREE;
+    }
+    single_unlock();
+
+    for (i = 0; i < count; i++) {
+        for (k = 0; k < done[i].callback_count; k++)
+            done[i].on_done[k](done[i].name, done[i].result, done[i].error, done[i].on_done_user[k]);
+        if (done[i].added && g_add_item_log_cb)
+            g_add_item_log_cb(done[i].name, done[i].result == STAR_API_SUCCESS ? 1 : 0, done[i].error, g_add_item_log_user);
+    }
+}
+
+/* Blocking wrapper: waits for the request (or the in-flight one it was merged with) to finish. The
+ * result arrives in a waiter record of its own, so it does not matter whether star_sync_pump frees
+ * the slot first. A finished slot with no on_done callbacks is freed here and its add_item log
+ * callback fires before returning, so callers that never pump do not fill the queue. */
 star_api_result_t star_sync_single_item(const char* name,
     const char* description,
     const char* game_source,
     const char* item_type,
     const char* nft_id) {
-    star_api_result_t res;
+    single_waiter_t waiter;
+    int id;
+    memset(&waiter, 0, sizeof(waiter));
     if (!name || !name[0]) return STAR_API_ERROR_INVALID_PARAM;
-    if (star_api_has_item(name))
-        return STAR_API_SUCCESS;
-    star_api_queue_add_item(name, description ? description : "", game_source ? game_source : "", item_type ? item_type : "KeyItem", nft_id, 1, 1);
-    res = star_api_flush_add_item_jobs();
-    if (g_add_item_log_cb) {
-        int success = (res == STAR_API_SUCCESS) ? 1 : 0;
-        const char* err = (res != STAR_API_SUCCESS) ? star_api_get_last_error() : "";
-        g_add_item_log_cb(name, success, err ? err : "", g_add_item_log_user);
+    id = single_item_enqueue(name, description, game_source, item_type, nft_id, NULL, NULL, &waiter);
+    if (!id) return STAR_API_ERROR_API_ERROR; /* queue full */
+    for (;;) {
+        star_api_result_t res;
+        int finished;
+        int run_here = 0;
+        int log_added = 0;
+        char log_name[256];
+        char log_error[SINGLE_ERROR_SIZE];
+        int i;
+        single_lock();
+        finished = waiter.done;
+        res = waiter.result;
+        if (finished) {
+            for (i = 0; i < SINGLE_QUEUE_SIZE; i++) {
+                single_req_t* r = &g_single_reqs[i];
+                if (r->id != id || r->state != SINGLE_DONE || r->callback_count > 0) continue;
+                log_added = r->added;
+                str_copy(log_name, r->name, sizeof(log_name));
+                str_copy(log_error, r->error, sizeof(log_error));
+                r->state = SINGLE_FREE;
+                break;
+            }
+        } else if (!g_single_worker_running) {
+            g_single_worker_running = 1; /* the worker thread could not be started */
+            run_here = 1;
+        }
+        single_unlock();
+        if (finished) {
+            if (log_added && g_add_item_log_cb)
+                g_add_item_log_cb(log_name, res == STAR_API_SUCCESS ? 1 : 0, log_error, g_add_item_log_user);
+            return res;
+        }
+        if (run_here) {
+            single_item_thread_proc(NULL);
+            continue;
+        }
+#ifdef _WIN32
+        Sleep(1);
+#else
+        {
+            struct timespec ts = { 0, 1000000 };
+            nanosleep(&ts, NULL);
+        }
+#endif
     }
-    return res;
 }
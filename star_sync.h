@@ -52,8 +52,9 @@ void star_sync_cleanup(void);
 void star_sync_pump(void);
 
 /* ---------------------------------------------------------------------------
- * Local item entry: one item to sync to remote (has_item then add_item if missing).
- * name, description, game_source, item_type are inputs; synced is output (1 when synced).
+ * Local item entry: one item to sync to remote (add_item if missing).
+ * name, description, game_source, item_type are inputs; entries with synced already set are skipped.
+ * The sync layer works on its own copy and does not write synced back (see star_sync_inventory_get_synced).
  * nft_id: optional; if set, add_item is called with this NFT ID (item is linked to NFTHolon).
  * Game allocates an array of these and passes to star_sync_inventory_start.
  * --------------------------------------------------------------------------- */
@@ -63,7 +64,7 @@ typedef struct star_sync_local_item {
     char game_source[64];
     char item_type[64];
     char nft_id[128];  /* optional; empty = no NFT. When set, add_item stores NFTId in item MetaData. */
-    int  synced;  /* output: set to 1 by sync layer when item is on remote */
+    int  synced;  /* 1 = already on remote, skip it */
 } star_sync_local_item_t;
 
 /* ---------------------------------------------------------------------------
@@ -102,8 +103,10 @@ void star_sync_auth_force_reset(void);
 /** Optional completion callback: invoked from main thread when star_sync_pump() sees inventory finished. In the callback, call star_sync_inventory_get_result() then star_sync_inventory_clear_result() when done. Pass NULL to use polling. */
 typedef void (*star_sync_inventory_on_done_fn)(void* user_data);
 
-/** Start inventory refresh on a background thread. Syncs local_items (has_item/add_item) then get_inventory.
- *  local_items may be NULL (or count 0) to only fetch inventory.
+/** Start inventory refresh on a background thread. Syncs local_items then get_inventory: one inventory fetch
+ *  decides which unsynced items are missing remotely, and those are added in a single flushed batch.
+ *  local_items may be NULL (or count 0) to only fetch inventory. The unsynced entries are copied before this
+ *  returns, so the caller may reuse or free the array at once; it is never written to.
  *  on_done and on_done_user: optional; if non-NULL, on_done(user_data) is called from main thread in star_sync_pump(). Pass NULL, NULL to use polling. */
 void star_sync_inventory_start(
     star_sync_local_item_t* local_items,
@@ -113,6 +116,24 @@ void star_sync_inventory_start(
     void* on_done_user
 );
 
+#if !defined(OASIS_STAR_SYNC_IN_CLIENT) || !OASIS_STAR_SYNC_IN_CLIENT
+/* Only in star_sync.c; the prebuilt star_api.dll/.lib does not export these. */
+
+/** Same as star_sync_inventory_start, but returns a non-zero handle for the refresh (0 if one is already in progress). */
+int star_sync_inventory_start_handle(
+    const star_sync_local_item_t* local_items,
+    int local_count,
+    const char* default_game_source,
+    star_sync_inventory_on_done_fn on_done,
+    void* on_done_user
+);
+
+/** Once the refresh with this handle has finished, writes the positions (in the local_items array passed to start)
+ *  of the entries it synced into indices_out, up to max_indices, and returns how many there are. Returns -1 while it
+ *  is in progress or after a newer refresh has started. */
+int star_sync_inventory_get_synced(int handle, int* indices_out, int max_indices);
+#endif
+
 /** Returns: 0 = in progress, 1 = finished (call star_sync_inventory_get_result and free the list), -1 = not started / no result */
 int star_sync_inventory_poll(void);
 
@@ -134,9 +155,36 @@ void star_sync_inventory_deliver_result(star_item_list_t* list, star_api_result_
 int star_sync_inventory_in_progress(void);
 
 /* ---------------------------------------------------------------------------
- * One-shot sync of a single local item (has_item then add_item if missing).
- * Can be called from main thread; use for immediate sync when e.g. player picks up a key.
+ * Single local item sync (has_item then add_item if missing), e.g. when the player picks up a key.
  * --------------------------------------------------------------------------- */
+
+#if !defined(OASIS_STAR_SYNC_IN_CLIENT) || !OASIS_STAR_SYNC_IN_CLIENT
+/* The non-blocking entry points are only in star_sync.c; the prebuilt star_api.dll/.lib does not export them. */
+
+/** Completion callback for star_sync_single_item_start, invoked from main thread in star_sync_pump(). */
+typedef void (*star_sync_single_item_on_done_fn)(const char* item_name, star_api_result_t result, const char* error_message, void* user_data);
+
+/** Queue a single-item sync and return at once; a background thread checks and adds it, batching with any other
+ *  pending requests. A request for an item that is already queued or in flight is merged with it, and every
+ *  caller's on_done fires (up to 4 per request). on_done may be NULL. Returns a non-zero request id, or 0 if name
+ *  is empty, the queue is full, or the merged request already has 4 callbacks. The add_item log callback also
+ *  fires from star_sync_pump(). */
+int star_sync_single_item_start(
+    const char* name,
+    const char* description,
+    const char* game_source,
+    const char* item_type,
+    const char* nft_id,  /* NULL or empty for non-NFT items */
+    star_sync_single_item_on_done_fn on_done,
+    void* on_done_user
+);
+
+/** Non-zero while a sync of this item is queued or in flight. */
+int star_sync_single_item_pending(const char* name);
+#endif
+
+/** Sync a single item (check, then add if missing) and wait for the result. Avoid on the game thread; it waits out
+ *  the network round trips. */
 star_api_result_t star_sync_single_item(
     const char* name,
     const char* description,
@@ -0,0 +1,163 @@
+/**
+ * Stress test for the star_sync.c inventory and single-item workers, against an in-process stand-in
+ * for star_api. Meant to run under ThreadSanitizer:
+ *
+ *   cc -std=c99 -g -fsanitize=thread -DOASIS_STAR_SYNC_IN_CLIENT=0 -I. \
+ *      star_sync.c tests/star_sync_stress.c -o star_sync_stress -lpthread && ./star_sync_stress
+ *
+ * The game thread starts inventory refreshes from a heap array that it frees as soon as
+ * star_sync_inventory_start_handle returns, while a second thread makes blocking single-item calls.
+ * Exits non-zero if a refresh reports the wrong synced entries or a blocking call fails.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "star_sync.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#define STRESS_ROUNDS        300
+#define STRESS_SINGLE_CALLS  200
+#define STRESS_ITEMS         6
+
+/* ---------------------------------------------------------------------------
+ * star_api stand-in: "a", "b" and "c" are already in the remote inventory.
+ * --------------------------------------------------------------------------- */
+static const char* g_remote[] = { "a", "b", "c" };
+static pthread_mutex_t g_stub_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_stub_queued = 0;
+
+bool star_api_has_item(const char* name) {
+    int i;
+    for (i = 0; i < 3; i++)
+        if (!strcmp(name, g_remote[i])) return 1;
+    return 0;
+}
+
+star_api_result_t star_api_get_inventory(star_item_list_t** list_out) {
+    star_item_list_t* list = (star_item_list_t*)calloc(1, sizeof(*list));
+    int i;
+    list->items = (star_item_t*)calloc(3, sizeof(star_item_t));
+    list->count = 3;
+    for (i = 0; i < 3; i++)
+        strcpy(list->items[i].name, g_remote[i]);
+    *list_out = list;
+    return STAR_API_SUCCESS;
+}
+
+void star_api_free_item_list(star_item_list_t* list) {
+    if (!list) return;
+    free(list->items);
+    free(list);
+}
+
+void star_api_queue_add_item(const char* name, const char* description, const char* game_source, const char* item_type, const char* nft_id, int quantity, int stack) {
+    (void)name; (void)description; (void)game_source; (void)item_type; (void)nft_id; (void)quantity; (void)stack;
+    pthread_mutex_lock(&g_stub_lock);
+    g_stub_queued++;
+    pthread_mutex_unlock(&g_stub_lock);
+}
+
+star_api_result_t star_api_flush_add_item_jobs(void) { return STAR_API_SUCCESS; }
+const char* star_api_get_last_error(void) { return ""; }
+void star_api_queue_use_item(const char* target, const char* item_name) { (void)target; (void)item_name; }
+star_api_result_t star_api_flush_use_item_jobs(void) { return STAR_API_SUCCESS; }
+
+star_api_result_t star_api_send_item_to_avatar(const char* target, const char* item_name, int quantity, const char* item_id) {
+    (void)target; (void)item_name; (void)quantity; (void)item_id;
+    return STAR_API_SUCCESS;
+}
+
+star_api_result_t star_api_send_item_to_clan(const char* target, const char* item_name, int quantity, const char* item_id) {
+    (void)target; (void)item_name; (void)quantity; (void)item_id;
+    return STAR_API_SUCCESS;
+}
+
+star_api_result_t star_api_get_avatar_id(char* avatar_id_out, size_t avatar_id_size) {
+    (void)avatar_id_out; (void)avatar_id_size;
+    return STAR_API_SUCCESS;
+}
+
+star_api_result_t star_api_authenticate_with_jwt_out(const char* username, const char* password, char* jwt_out, size_t jwt_size) {
+    (void)username; (void)password; (void)jwt_out; (void)jwt_size;
+    return STAR_API_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------
+ * Test
+ * --------------------------------------------------------------------------- */
+static void stress_sleep_us(long us) {
+    struct timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = us * 1000L;
+    nanosleep(&ts, NULL);
+}
+
+static void* single_item_thread(void* param) {
+    int* failures = (int*)param;
+    char name[32];
+    int i;
+    for (i = 0; i < STRESS_SINGLE_CALLS; i++) {
+        snprintf(name, sizeof(name), "key%d", i % 8);
+        if (star_sync_single_item(name, "key", "Stress", "KeyItem", NULL) != STAR_API_SUCCESS)
+            (*failures)++;
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t single;
+    int single_failures = 0;
+    int bad_rounds = 0;
+    int round;
+
+    star_sync_init();
+    if (pthread_create(&single, NULL, single_item_thread, &single_failures) != 0) {
+        fprintf(stderr, "star_sync_stress: could not start thread\n");
+        return 1;
+    }
+
+    for (round = 0; round < STRESS_ROUNDS; round++) {
+        star_sync_local_item_t* items = (star_sync_local_item_t*)calloc(STRESS_ITEMS, sizeof(*items));
+        int indices[STRESS_ITEMS];
+        int handle;
+        int count;
+
+        strcpy(items[0].name, "a");
+        strcpy(items[1].name, "zz");
+        strcpy(items[2].name, "b");
+        items[2].synced = 1;                /* skipped */
+        strcpy(items[3].name, "q_000001");  /* stack event */
+        strcpy(items[4].name, "zz");        /* duplicate in the same batch */
+        strcpy(items[5].name, "new");
+        handle = star_sync_inventory_start_handle(items, STRESS_ITEMS, "Stress", NULL, NULL);
+        memset(items, 0xAA, STRESS_ITEMS * sizeof(*items));  /* the sync layer must not look at it again */
+        free(items);
+        if (!handle) {
+            bad_rounds++;
+            continue;
+        }
+
+        while (star_sync_inventory_poll() == 0) {
+            star_sync_pump();
+            stress_sleep_us(100);
+        }
+        count = star_sync_inventory_get_synced(handle, indices, STRESS_ITEMS);
+        if (count != 5 || indices[0] != 0 || indices[1] != 1 || indices[2] != 3 || indices[3] != 4 || indices[4] != 5)
+            bad_rounds++;
+        star_sync_inventory_clear_result();
+        if (star_sync_inventory_get_synced(handle + 1, NULL, 0) != -1)
+            bad_rounds++;
+    }
+
+    pthread_join(single, NULL);
+    star_sync_pump();
+    star_sync_cleanup();
+
+    printf("star_sync_stress: %d/%d refreshes ok, %d blocking single-item failures, %d add_item calls\n",
+        STRESS_ROUNDS - bad_rounds, STRESS_ROUNDS, single_failures, g_stub_queued);
+    return (bad_rounds || single_failures) ? 1 : 0;
+}